@@ -0,0 +1,86 @@
+// svgo config of assets workflow, removal of self clips and default preset.
+//
+// Logos clip a group with a clip path of the same shape as the only shape
+// in the group, which is drawn once more right before the group:
+//
+//   <circle cx="22.114" cy="36.193" r="3.21" fill="#fff" />
+//   <clipPath id="prefix__a"><circle cx="22.114" cy="36.193" r="3.21" /></clipPath>
+//   <g clip-path="url(#prefix__a)"><circle cx="22.114" cy="36.193" r="3.21" fill="#fff" /></g>
+//
+// removeUselessDefs keeps such clip path since it is referenced, so the clip
+// is removed here: group is replaced by its shape, shape is dropped when it
+// repeats previous sibling and clip paths no longer referenced are removed.
+
+const elements = (node) => node.children.filter((child) => child.type === 'element')
+
+const same = (a, b, ignore = []) => {
+  const keys = (node) => Object.keys(node.attributes).filter((key) => !ignore.includes(key))
+  return a.name === b.name && keys(a).length === keys(b).length &&
+    keys(a).every((key) => a.attributes[key] === b.attributes[key])
+}
+
+const walk = (node, fn) => {
+  for (const child of elements(node)) {
+    walk(child, fn)
+    fn(child, node)
+  }
+}
+
+const removeSelfClips = {
+  name: 'removeSelfClips',
+  fn: () => ({
+    root: {
+      enter: (root) => {
+        const clips = new Map()
+        walk(root, (node) => {
+          if (node.name === 'clipPath' && node.attributes.id) clips.set(node.attributes.id, node)
+        })
+
+        walk(root, (node, parent) => {
+          const match = /^url\(#(.+)\)$/.exec(node.attributes['clip-path'] || '')
+          if (node.name !== 'g' || !match || Object.keys(node.attributes).length !== 1) return
+          const clip = clips.get(match[1])
+          if (!clip || (clip.attributes.clipPathUnits || 'userSpaceOnUse') !== 'userSpaceOnUse') return
+          const [shape, ...restOfGroup] = elements(node)
+          const [outline, ...restOfClip] = elements(clip)
+          if (!shape || !outline || restOfGroup.length > 0 || restOfClip.length > 0) return
+          // every attribute of clip shape is geometry the shape shares, shape
+          // may only add paint, so clipping it changes nothing
+          if (shape.name !== outline.name || shape.attributes.transform !== outline.attributes.transform ||
+            Object.keys(outline.attributes).some((key) => key !== 'id' &&
+              shape.attributes[key] !== outline.attributes[key])) return
+
+          // clip paths are not drawn, so they do not separate drawn siblings
+          const siblings = elements(parent).filter((child) => child.name !== 'clipPath')
+          const previous = siblings[siblings.indexOf(node) - 1]
+          const at = parent.children.indexOf(node)
+          if (previous && same(previous, shape, ['id']) && previous.children.length === 0) {
+            parent.children.splice(at, 1)
+          } else {
+            parent.children.splice(at, 1, shape)
+          }
+        })
+
+        const referenced = new Set()
+        walk(root, (node) => {
+          for (const value of Object.values(node.attributes)) {
+            for (const [, id] of value.matchAll(/url\(#([^)]+)\)/g)) referenced.add(id)
+            if (value.startsWith('#')) referenced.add(value.slice(1))
+          }
+        })
+        walk(root, (node, parent) => {
+          if (node.name === 'clipPath' && !referenced.has(node.attributes.id)) {
+            parent.children.splice(parent.children.indexOf(node), 1)
+          }
+        })
+      },
+    },
+  }),
+}
+
+module.exports = {
+  plugins: [
+    removeSelfClips,
+    'preset-default',
+  ],
+}
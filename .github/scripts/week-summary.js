@@ -0,0 +1,175 @@
+// Helpers shared by week summary jobs of github-tasks workflow. Every repository
+// using the workflow checks them out from howijd/howijd.network and loads them
+// with actions/github-script:
+//
+//   const summary = require('./week-summary-scripts/.github/scripts/week-summary.js')({ github, core })
+
+const defaults = [
+  '.github',
+  'howi',
+  'howijd.network',
+  'howijd.org',
+  'howijd.com',
+]
+
+// CLOSED ISSUES, closedAt window is filtered by search
+const issuesQuery = `query ($search: String!, $cursor: String) {
+  search(query: $search, type: ISSUE, first: 100, after: $cursor) {
+    pageInfo {
+      hasNextPage
+      endCursor
+    }
+    nodes {
+      ... on Issue {
+        url
+      }
+    }
+  }
+}`
+
+// MERGED PULL REQUESTS, mergedAt window is filtered by search
+const pullRequestsQuery = `query ($search: String!, $cursor: String) {
+  search(query: $search, type: ISSUE, first: 100, after: $cursor) {
+    pageInfo {
+      hasNextPage
+      endCursor
+    }
+    nodes {
+      ... on PullRequest {
+        url
+      }
+    }
+  }
+}`
+
+// repositories from comma or whitespace separated owner/repo or howijd repo
+// names, e.g. WEEK_SUMMARY_REPOS variable, as [owner, repo] pairs
+const getRepos = (list) => (list ? list.split(/[\s,]+/).filter(Boolean) : defaults)
+  .map((name) => name.includes('/') ? name.split('/') : ['howijd', name])
+
+// searches of issues closed and pull requests merged since date, also
+// used for week counts so that lists and counts agree
+const closedSearch = (owner, repo, since) =>
+  `repo:${owner}/${repo} is:issue is:closed -label:draft closed:>=${since.slice(0, 10)}`
+const mergedSearch = (owner, repo, since) =>
+  `repo:${owner}/${repo} is:pr is:merged merged:>=${since.slice(0, 10)}`
+
+// start of this week as ISO string, weeks start on monday
+const getmonday = () => {
+  const now = new Date()
+  const mon = new Date(now.toUTCString().slice(0, -4))
+  if (mon.getDay() === 1) {
+    mon.setDate(mon.getDate() - 1)
+  }
+  mon.setDate(mon.getDate() - (mon.getDay() + 6) % 7)
+  mon.setHours(0, 0, 0, 0)
+  return mon.toISOString()
+}
+
+// same as date +"%W-%Y", weeks start on monday
+const getweek = () => {
+  const now = new Date()
+  const yday = Math.floor((now - Date.UTC(now.getUTCFullYear(), 0, 1)) / 86400000)
+  const week = Math.floor((yday + 7 - (now.getUTCDay() + 6) % 7) / 7)
+  return `${String(week).padStart(2, '0')}-${now.getUTCFullYear()}`
+}
+
+// heading of repository section, owner is left out only for howijd so that
+// same named repositories of other owners are not mixed up
+const heading = (owner, repo) => `### ${owner === 'howijd' ? repo : `${owner}/${repo}`}`
+
+// repository section of summary, lines are joined once
+const section = (owner, repo, issues, pullRequests) => [
+  heading(owner, repo), '',
+  '#### ISSUES', '',
+  ...issues.map((url) => `- [x] ${url}`), '',
+  '#### PULL REQUESTS', '',
+  ...pullRequests.map((url) => `- [x] ${url}`), '',
+].join('\n')
+
+module.exports = ({ github, core }) => {
+  const monday = getmonday()
+  const week = getweek()
+  const title = `WEEK SUMMARY ${week}`
+
+  // batch crawl keeps a reserve of rate limit for interactive events
+  // (greetings, reactions, labels) and waits for reset instead of using it
+  const reserveRateLimit = (reserve = 100) => {
+    const limits = {}
+    github.hook.after('request', (response) => {
+      const { headers } = response
+      if (headers['x-ratelimit-resource']) {
+        limits[headers['x-ratelimit-resource']] = {
+          remaining: Number(headers['x-ratelimit-remaining']),
+          reset: Number(headers['x-ratelimit-reset']) * 1000,
+        }
+      }
+    })
+    github.hook.before('request', async (options) => {
+      const resource = options.url === '/graphql' ? 'graphql' : 'core'
+      const limit = limits[resource]
+      if (!limit || limit.remaining > reserve) return
+      const wait = limit.reset - Date.now()
+      if (wait > 0) {
+        core.info(`${resource} rate limit at reserve, waiting ${Math.ceil(wait / 1000)}s for reset`)
+        await new Promise((resolve) => setTimeout(resolve, wait))
+      }
+      delete limits[resource]
+    })
+  }
+
+  // walk connection page by page following pageInfo.endCursor
+  const paginate = async (query, vars, connection, onNode) => {
+    let cursor = null
+    do {
+      const res = await github.graphql(query, { ...vars, cursor })
+      const { nodes, pageInfo } = connection(res)
+      nodes.forEach(onNode)
+      cursor = pageInfo.hasNextPage ? pageInfo.endCursor : null
+    } while (cursor)
+  }
+
+  // open repository drafts of any week, left open ones of past weeks included
+  const listDrafts = async (owner, repo) => {
+    const drafts = await github.paginate(github.rest.issues.listForRepo, {
+      owner, repo, state: 'open', labels: 'draft', per_page: 100,
+    })
+    return drafts.filter((issue) => issue.title.startsWith('WEEK SUMMARY ') &&
+      (issue.body || '').startsWith(`${heading(owner, repo)}\n`))
+  }
+
+  // open draft of this week kept up to date by update-week-summary
+  const findDraft = async (owner, repo) =>
+    (await listDrafts(owner, repo)).find((issue) => issue.title === title)
+
+  // crawl closed issues and merged pull requests of this week into section
+  const crawlSection = async (owner, repo) => {
+    const issues = []
+    const pullRequests = []
+    await Promise.all([
+      paginate(issuesQuery, { search: closedSearch(owner, repo, monday) },
+        (res) => res.search, (node) => issues.push(node.url)),
+      paginate(pullRequestsQuery, { search: mergedSearch(owner, repo, monday) },
+        (res) => res.search, (node) => pullRequests.push(node.url)),
+    ])
+    return section(owner, repo, issues, pullRequests)
+  }
+
+  return {
+    monday,
+    week,
+    title,
+    issuesQuery,
+    pullRequestsQuery,
+    closedSearch,
+    mergedSearch,
+    getRepos,
+    heading,
+    section,
+    reserveRateLimit,
+    paginate,
+    listDrafts,
+    findDraft,
+    crawlSection,
+  }
+}